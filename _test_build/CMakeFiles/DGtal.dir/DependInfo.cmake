@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Board/Board.cpp" "CMakeFiles/DGtal.dir/src/Board/Board.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/Board/Board.cpp.o.d"
+  "/root/repo/src/Board/PSFonts.cpp" "CMakeFiles/DGtal.dir/src/Board/PSFonts.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/Board/PSFonts.cpp.o.d"
+  "/root/repo/src/Board/Path.cpp" "CMakeFiles/DGtal.dir/src/Board/Path.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/Board/Path.cpp.o.d"
+  "/root/repo/src/Board/Rect.cpp" "CMakeFiles/DGtal.dir/src/Board/Rect.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/Board/Rect.cpp.o.d"
+  "/root/repo/src/Board/ShapeList.cpp" "CMakeFiles/DGtal.dir/src/Board/ShapeList.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/Board/ShapeList.cpp.o.d"
+  "/root/repo/src/Board/Shapes.cpp" "CMakeFiles/DGtal.dir/src/Board/Shapes.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/Board/Shapes.cpp.o.d"
+  "/root/repo/src/Board/Tools.cpp" "CMakeFiles/DGtal.dir/src/Board/Tools.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/Board/Tools.cpp.o.d"
+  "/root/repo/src/Board/Transforms.cpp" "CMakeFiles/DGtal.dir/src/Board/Transforms.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/Board/Transforms.cpp.o.d"
+  "/root/repo/src/BoostAddons/zlib.cpp" "CMakeFiles/DGtal.dir/src/BoostAddons/zlib.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/BoostAddons/zlib.cpp.o.d"
+  "/root/repo/src/DGtal/base/Bits.cpp" "CMakeFiles/DGtal.dir/src/DGtal/base/Bits.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/DGtal/base/Bits.cpp.o.d"
+  "/root/repo/src/DGtal/base/Common.cpp" "CMakeFiles/DGtal.dir/src/DGtal/base/Common.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/DGtal/base/Common.cpp.o.d"
+  "/root/repo/src/DGtal/base/ParallelExecutor.cpp" "CMakeFiles/DGtal.dir/src/DGtal/base/ParallelExecutor.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/DGtal/base/ParallelExecutor.cpp.o.d"
+  "/root/repo/src/DGtal/io/Color.cpp" "CMakeFiles/DGtal.dir/src/DGtal/io/Color.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/DGtal/io/Color.cpp.o.d"
+  "/root/repo/src/DGtal/io/boards/Board2D.cpp" "CMakeFiles/DGtal.dir/src/DGtal/io/boards/Board2D.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/DGtal/io/boards/Board2D.cpp.o.d"
+  "/root/repo/src/DGtal/io/boards/Board3D.cpp" "CMakeFiles/DGtal.dir/src/DGtal/io/boards/Board3D.cpp.o" "gcc" "CMakeFiles/DGtal.dir/src/DGtal/io/boards/Board3D.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
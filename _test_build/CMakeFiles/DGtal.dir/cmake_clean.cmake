@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DGtal.dir/src/Board/Board.cpp.o"
+  "CMakeFiles/DGtal.dir/src/Board/Board.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/Board/PSFonts.cpp.o"
+  "CMakeFiles/DGtal.dir/src/Board/PSFonts.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/Board/Path.cpp.o"
+  "CMakeFiles/DGtal.dir/src/Board/Path.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/Board/Rect.cpp.o"
+  "CMakeFiles/DGtal.dir/src/Board/Rect.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/Board/ShapeList.cpp.o"
+  "CMakeFiles/DGtal.dir/src/Board/ShapeList.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/Board/Shapes.cpp.o"
+  "CMakeFiles/DGtal.dir/src/Board/Shapes.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/Board/Tools.cpp.o"
+  "CMakeFiles/DGtal.dir/src/Board/Tools.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/Board/Transforms.cpp.o"
+  "CMakeFiles/DGtal.dir/src/Board/Transforms.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/BoostAddons/zlib.cpp.o"
+  "CMakeFiles/DGtal.dir/src/BoostAddons/zlib.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/DGtal/base/Bits.cpp.o"
+  "CMakeFiles/DGtal.dir/src/DGtal/base/Bits.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/DGtal/base/Common.cpp.o"
+  "CMakeFiles/DGtal.dir/src/DGtal/base/Common.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/DGtal/base/ParallelExecutor.cpp.o"
+  "CMakeFiles/DGtal.dir/src/DGtal/base/ParallelExecutor.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/DGtal/io/Color.cpp.o"
+  "CMakeFiles/DGtal.dir/src/DGtal/io/Color.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/DGtal/io/boards/Board2D.cpp.o"
+  "CMakeFiles/DGtal.dir/src/DGtal/io/boards/Board2D.cpp.o.d"
+  "CMakeFiles/DGtal.dir/src/DGtal/io/boards/Board3D.cpp.o"
+  "CMakeFiles/DGtal.dir/src/DGtal/io/boards/Board3D.cpp.o.d"
+  "libDGtal.pdb"
+  "libDGtal.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DGtal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
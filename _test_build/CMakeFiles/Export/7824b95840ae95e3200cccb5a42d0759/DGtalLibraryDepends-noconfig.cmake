@@ -0,0 +1,19 @@
+#----------------------------------------------------------------
+# Generated CMake target import file.
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "DGtal" for configuration ""
+set_property(TARGET DGtal APPEND PROPERTY IMPORTED_CONFIGURATIONS NOCONFIG)
+set_target_properties(DGtal PROPERTIES
+  IMPORTED_LOCATION_NOCONFIG "/usr/local/lib/libDGtal.so"
+  IMPORTED_SONAME_NOCONFIG "libDGtal.so"
+  )
+
+list(APPEND _cmake_import_check_targets DGtal )
+list(APPEND _cmake_import_check_files_for_DGtal "/usr/local/lib/libDGtal.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
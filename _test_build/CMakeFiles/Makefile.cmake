@@ -0,0 +1,447 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/BuildExamples.cmake"
+  "/root/repo/cmake/CheckCoverage.cmake"
+  "/root/repo/cmake/CheckDGtalDependencies.cmake"
+  "/root/repo/cmake/CheckDGtalOptionalDependencies.cmake"
+  "/root/repo/cmake/Common.cmake"
+  "/root/repo/cmake/CpackCtest.cmake"
+  "/root/repo/cmake/DGtalConfig.cmake.in"
+  "/root/repo/cmake/DGtalConfigGenerator.cmake"
+  "/root/repo/cmake/DGtalConfigVersion.cmake.in"
+  "/root/repo/cmake/DevelopmentOptions.cmake"
+  "/root/repo/cmake/FetchExternalDeps.cmake"
+  "/root/repo/cmake/FindDoxygen.cmake"
+  "/root/repo/cmake/FindPackageHandleStandardArgs.cmake"
+  "/root/repo/cmake/FindPackageMessage.cmake"
+  "/root/repo/cmake/GeneratorSpecific.cmake"
+  "/root/repo/cmake/Install.cmake"
+  "/root/repo/cmake/NeighborhoodTablesConfig.cmake"
+  "/root/repo/cmake/OSDependentSettings.cmake"
+  "/root/repo/cmake/PythonWrappings.cmake"
+  "/root/repo/cmake/TargetDoxygenDoc.cmake"
+  "/root/repo/cmake/TargetDoxygenDox.cmake"
+  "/root/repo/cmake/TargetUninstall.cmake.in"
+  "/root/repo/cmake/doxygen.cmake"
+  "/root/repo/src/Board/ModuleSRC.cmake"
+  "/root/repo/src/BoostAddons/ModuleSRC.cmake"
+  "/root/repo/src/DGtal/base/Config.h.in"
+  "/root/repo/src/DGtal/base/ModuleSRC.cmake"
+  "/root/repo/src/DGtal/helpers/ModuleSRC.cmake"
+  "/root/repo/src/DGtal/io/ModuleSRC.cmake"
+  "/root/repo/src/DGtal/kernel/ModuleSRC.cmake"
+  "/root/repo/src/DGtal/topology/tables/NeighborhoodTables.h.in"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/ConfigTest.h.in"
+  "/root/repo/tests/TestFunctions.cmake"
+  "/root/repo/tests/arithmetic/CMakeLists.txt"
+  "/root/repo/tests/base/CMakeLists.txt"
+  "/root/repo/tests/dec/CMakeLists.txt"
+  "/root/repo/tests/geometry/CMakeLists.txt"
+  "/root/repo/tests/geometry/curves/CMakeLists.txt"
+  "/root/repo/tests/geometry/curves/estimation/CMakeLists.txt"
+  "/root/repo/tests/geometry/surfaces/CMakeLists.txt"
+  "/root/repo/tests/geometry/tools/CMakeLists.txt"
+  "/root/repo/tests/geometry/tools/determinant/CMakeLists.txt"
+  "/root/repo/tests/geometry/volumes/CMakeLists.txt"
+  "/root/repo/tests/geometry/volumes/distance/CMakeLists.txt"
+  "/root/repo/tests/geometry/volumes/estimation/CMakeLists.txt"
+  "/root/repo/tests/graph/CMakeLists.txt"
+  "/root/repo/tests/helpers/CMakeLists.txt"
+  "/root/repo/tests/images/CMakeLists.txt"
+  "/root/repo/tests/io/CMakeLists.txt"
+  "/root/repo/tests/io/boards/CMakeLists.txt"
+  "/root/repo/tests/io/colormaps/CMakeLists.txt"
+  "/root/repo/tests/io/readers/CMakeLists.txt"
+  "/root/repo/tests/io/viewers/CMakeLists.txt"
+  "/root/repo/tests/io/writers/CMakeLists.txt"
+  "/root/repo/tests/kernel/CMakeLists.txt"
+  "/root/repo/tests/math/CMakeLists.txt"
+  "/root/repo/tests/math/linalg/CMakeLists.txt"
+  "/root/repo/tests/shapes/CMakeLists.txt"
+  "/root/repo/tests/topology/CMakeLists.txt"
+  "/tmp/catch2src/CMakeLists.txt"
+  "/tmp/catch2src/contrib/Catch.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FetchContent.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/InstallRequiredSystemLibraries.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "TargetUninstall.cmake"
+  "src/DGtal/base/Config.h"
+  "DartConfiguration.tcl"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "DartConfiguration.tcl"
+  "DGtalConfig.cmake"
+  "DGtalConfigVersion.cmake"
+  "InstallFiles/DGtalConfig.cmake"
+  "InstallFiles/DGtalConfigVersion.cmake"
+  "src/DGtal/topology/tables/NeighborhoodTables.h"
+  "InstallFiles/NeighborhoodTables.h"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "_deps/catch2-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/ConfigTest.h"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/base/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/kernel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/math/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/math/linalg/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/arithmetic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/curves/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/volumes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/volumes/estimation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/surfaces/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/geometry/tools/determinant/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/graph/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/topology/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/viewers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/boards/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/colormaps/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/readers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/io/writers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/images/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/helpers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/shapes/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/dec/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "CMakeFiles/distclean.dir/DependInfo.cmake"
+  "CMakeFiles/DGtal.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/lcov.dir/DependInfo.cmake"
+  "CMakeFiles/_base.dir/DependInfo.cmake"
+  "CMakeFiles/_math.dir/DependInfo.cmake"
+  "CMakeFiles/_kernel.dir/DependInfo.cmake"
+  "CMakeFiles/_topology.dir/DependInfo.cmake"
+  "CMakeFiles/_geometry.dir/DependInfo.cmake"
+  "CMakeFiles/_io.dir/DependInfo.cmake"
+  "CMakeFiles/_images.dir/DependInfo.cmake"
+  "CMakeFiles/_shapes.dir/DependInfo.cmake"
+  "CMakeFiles/_arithmetic.dir/DependInfo.cmake"
+  "CMakeFiles/_graph.dir/DependInfo.cmake"
+  "CMakeFiles/_helpers.dir/DependInfo.cmake"
+  "CMakeFiles/_dec.dir/DependInfo.cmake"
+  "tests/CMakeFiles/DGtalCatch.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testBasicBoolFunctors.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testOrderedAlphabet.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCirculator.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testConstIteratorAdapter.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testProgressBar.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testBasicFunctors.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testConstRangeAdapter.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testOutputIteratorAdapter.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testClock.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testTrace.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCountedPtr.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCountedPtrOrPtr.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCountedConstPtrOrConstPtr.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testBits.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testIndexedListWithBlocks.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testLabels.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testLabelledMap.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testFlatHashMap.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testLabelledMap-benchmark.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testMultiMap-benchmark.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testOpenMP.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testParallelExecutor.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testIteratorFunctions.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testIteratorCirculatorTraits.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testCloneAndAliases.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testClone2.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testOwningOrAliasingPtr.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testPartialTemplateSpecialization.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testContainerTraits.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testSetFunctions.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testSimpleRandomAccessRangeFromPoint.dir/DependInfo.cmake"
+  "tests/base/CMakeFiles/testFunctorHolder.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testDigitalSet.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testHyperRectDomain.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testInteger.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testPointVector.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testLinearAlgebra.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testImagesSetsUtilities.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testBasicPointFunctors.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testEmbedder.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testPointPredicateConcepts.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testPointHashFunctions.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testLinearizer.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testPointFunctorHolder.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testNumberTraits.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testUnorderedSetByBlock.dir/DependInfo.cmake"
+  "tests/kernel/CMakeFiles/testIntegerConverter.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testSimpleRegression.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testMeasure.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testSignal.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testStatistics.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testHistogram.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testMPolynomial.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testAngleLinearMinimizer.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testBasicMathFunctions.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testMultiStatistics.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testProfile.dir/DependInfo.cmake"
+  "tests/math/CMakeFiles/testMeaningfulScaleAnalysis.dir/DependInfo.cmake"
+  "tests/math/linalg/CMakeFiles/testSimpleMatrix.dir/DependInfo.cmake"
+  "tests/math/linalg/CMakeFiles/testEigenDecomposition.dir/DependInfo.cmake"
+  "tests/arithmetic/CMakeFiles/testModuloComputer.dir/DependInfo.cmake"
+  "tests/arithmetic/CMakeFiles/testPattern.dir/DependInfo.cmake"
+  "tests/geometry/CMakeFiles/testContourHelper.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithDSS3d.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testFreemanChain.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testSegmentation.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testFP.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testGridCurve.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testCombinDSS.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testStabbingLineComputer.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testStabbingCircleComputer.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testBinomialConvolver.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testFrechetShortcut.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithmeticalDSS.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithmeticalDSLKernel.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithmeticalDSSComputer.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithmeticalDSL.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testDSLSubsegment.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithDSSIterator.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testArithmeticalDSSConvexHull.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testAlphaThickSegmentComputer.dir/DependInfo.cmake"
+  "tests/geometry/curves/CMakeFiles/testParametricCurveDigitization.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testLengthEstimators.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testTrueLocalEstimator.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testEstimatorComparator.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testSegmentComputerEstimators.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testMostCenteredMSEstimator.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testLambdaMST2D.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testLambdaMST3D.dir/DependInfo.cmake"
+  "tests/geometry/curves/estimation/CMakeFiles/testLambdaMST3DBy2D.dir/DependInfo.cmake"
+  "tests/geometry/volumes/CMakeFiles/testKanungo.dir/DependInfo.cmake"
+  "tests/geometry/volumes/CMakeFiles/testBoundedLatticePolytope.dir/DependInfo.cmake"
+  "tests/geometry/volumes/CMakeFiles/testBoundedRationalPolytope.dir/DependInfo.cmake"
+  "tests/geometry/volumes/CMakeFiles/testCellGeometry.dir/DependInfo.cmake"
+  "tests/geometry/volumes/CMakeFiles/testDigitalConvexity.dir/DependInfo.cmake"
+  "tests/geometry/volumes/CMakeFiles/testConvexityHelper.dir/DependInfo.cmake"
+  "tests/geometry/volumes/estimation/CMakeFiles/testMeasureSet.dir/DependInfo.cmake"
+  "tests/geometry/volumes/estimation/CMakeFiles/testVoronoiCovarianceMeasure.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testDistanceTransformation.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testDistanceTransformationND.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testDistanceTransformationMetrics.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testReverseDT.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testFMM.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testHeapFMM.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testVoronoiMap.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testMetrics.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testMetricBalls.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testPowerMap.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testReducedMedialAxis.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testSeparableMetricAdapter.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testChamferDT.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testChamferVoro.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testDigitalMetricAdapter.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testLpMetric.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testNarrowBandDistanceTransformation.dir/DependInfo.cmake"
+  "tests/geometry/volumes/distance/CMakeFiles/testMorphology.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testArithmeticalDSSComputerOnSurfels.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testChordGenericStandardPlaneComputer.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testDigitalPlanePredicate.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testPlaneProbingTetrahedronEstimator.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testPlaneProbingParallelepipedEstimator.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testIntegralInvariantShortcuts.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testNormalVectorEstimatorEmbedder.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testIntegralInvariantVolumeEstimator.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testIntegralInvariantCovarianceEstimator.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testLocalEstimatorFromFunctorAdapter.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testVoronoiCovarianceMeasureOnSurface.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testTensorVoting.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testEstimatorCache.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testSphericalHoughNormalVectorEstimator.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testDigitalSurfaceRegularization.dir/DependInfo.cmake"
+  "tests/geometry/surfaces/CMakeFiles/testShroudsRegularization.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testRayIntersection.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testPreimage.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testSphericalAccumulator.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testHullFunctions2D.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testPolarPointComparatorBy2x2DetComputer.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testConvexHull2D.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testConvexHull2DThickness.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testConvexHull2DReverse.dir/DependInfo.cmake"
+  "tests/geometry/tools/CMakeFiles/testQuickHull.dir/DependInfo.cmake"
+  "tests/geometry/tools/determinant/CMakeFiles/test2x2DetComputers.dir/DependInfo.cmake"
+  "tests/geometry/tools/determinant/CMakeFiles/testInHalfPlane.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testBreadthFirstPropagation.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testDepthFirstPropagation.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testObjectBoostGraphInterface.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testDistancePropagation.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testExpander.dir/DependInfo.cmake"
+  "tests/graph/CMakeFiles/testSTLMapToVertexMapAdapter.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testAdjacency.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testKhalimskySpaceND.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testPackedKhalimskySpace.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testCubicalComplex.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testVoxelComplex.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testDigitalSurface.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testDigitalTopology.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testObject.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testObjectBorder.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testSimpleExpander.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testSCellsFunctor.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testUmbrellaComputer.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testSurfaceHelper.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testDigitalSetToCellularGridConverter.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testNeighborhoodConfigurations.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testParDirCollapse.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testHalfEdgeDataStructure.dir/DependInfo.cmake"
+  "tests/topology/CMakeFiles/testIndexedDigitalSurface.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testColor.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testSimpleBoard.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testBoard2DCustomStyle.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testLongvol.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testChunkedVol.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testRunLengthVol.dir/DependInfo.cmake"
+  "tests/io/CMakeFiles/testArcDrawing.dir/DependInfo.cmake"
+  "tests/io/boards/CMakeFiles/testBoard3D.dir/DependInfo.cmake"
+  "tests/io/boards/CMakeFiles/testBallQuad.dir/DependInfo.cmake"
+  "tests/io/colormaps/CMakeFiles/testTickedColorMap.dir/DependInfo.cmake"
+  "tests/io/colormaps/CMakeFiles/testColorMaps.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testPNMReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testVolReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testRawReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testGenericReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testPointListReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testTableReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testMeshReader.dir/DependInfo.cmake"
+  "tests/io/readers/CMakeFiles/testMPolynomialReader.dir/DependInfo.cmake"
+  "tests/io/writers/CMakeFiles/testCompressedVolWriter.dir/DependInfo.cmake"
+  "tests/io/writers/CMakeFiles/testPNMRawWriter.dir/DependInfo.cmake"
+  "tests/io/writers/CMakeFiles/testMeshWriter.dir/DependInfo.cmake"
+  "tests/io/writers/CMakeFiles/testGenericWriter.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageSimple.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageAdapter.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageCache.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testTiledImage.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testConcurrentTiledImage.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageFactoryFromRawFile.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testConstImageAdapter.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImage.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageSpanIterators.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testCheckImageConcept.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testMorton.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testHashTree.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testSliceImageFromFunctor.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testRigidTransformation2D.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testRigidTransformation3D.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testArrayImageAdapter.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testConstImageFunctorHolder.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageContainerByLinearizedPoints.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageContainerByMappedFile.dir/DependInfo.cmake"
+  "tests/images/CMakeFiles/testImageContainerByBricks.dir/DependInfo.cmake"
+  "tests/helpers/CMakeFiles/testParametricShape.dir/DependInfo.cmake"
+  "tests/helpers/CMakeFiles/testImplicitShape.dir/DependInfo.cmake"
+  "tests/helpers/CMakeFiles/testParameters.dir/DependInfo.cmake"
+  "tests/helpers/CMakeFiles/testShortcuts.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testGaussDigitizer.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testHalfPlane.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testImplicitFunctionModels.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testShapesFromPoints.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testMesh.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testMeshVoxelization.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testBall3DSurface.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testEuclideanShapesDecorator.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testDigitalShapesDecorator.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testTriangulatedSurface.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testPolygonalSurface.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testSurfaceMesh.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testProjection.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testShapeMoveCenter.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testAstroid2D.dir/DependInfo.cmake"
+  "tests/shapes/CMakeFiles/testLemniscate2D.dir/DependInfo.cmake"
+  )
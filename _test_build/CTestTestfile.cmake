@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_test_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("_deps/catch2-build")
+subdirs("tests")
@@ -0,0 +1,17 @@
+/** 
+ * @file
+ * @author David Coeurjolly (\c david.coeurjolly@liris.cnrs.fr )
+ * Laboratoire d'InfoRmatique en Image et Systèmes d'information - LIRIS (CNRS, UMR 5205), CNRS, France
+ *
+ * @date 2009/12/19
+ * 
+ * Input file for making Configuration file. 
+ *
+ * This file is part of the DGtal library.
+ */
+
+#include <iostream>
+#include <string>
+
+#define DGTAL_VERSION "1.2.beta"
+/* #undef DGTAL_NO_ESCAPED_CHAR_IN_TRACE */
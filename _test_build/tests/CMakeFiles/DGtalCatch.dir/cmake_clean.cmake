@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/DGtalCatch.dir/DGtalCatch.cpp.o"
+  "CMakeFiles/DGtalCatch.dir/DGtalCatch.cpp.o.d"
+  "libDGtalCatch.a"
+  "libDGtalCatch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/DGtalCatch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
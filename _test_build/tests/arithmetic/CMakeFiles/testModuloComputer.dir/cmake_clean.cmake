@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testModuloComputer.dir/testModuloComputer.cpp.o"
+  "CMakeFiles/testModuloComputer.dir/testModuloComputer.cpp.o.d"
+  "testModuloComputer"
+  "testModuloComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testModuloComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPattern.dir/testPattern.cpp.o"
+  "CMakeFiles/testPattern.dir/testPattern.cpp.o.d"
+  "testPattern"
+  "testPattern.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPattern.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/arithmetic
+# Build directory: /root/repo/_test_build/tests/arithmetic
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testModuloComputer "testModuloComputer")
+set_tests_properties(testModuloComputer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/arithmetic/CMakeLists.txt;7;DGtal_add_test;/root/repo/tests/arithmetic/CMakeLists.txt;0;")
+add_test(testPattern "testPattern")
+set_tests_properties(testPattern PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/arithmetic/CMakeLists.txt;7;DGtal_add_test;/root/repo/tests/arithmetic/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBasicBoolFunctors.dir/testBasicBoolFunctors.cpp.o"
+  "CMakeFiles/testBasicBoolFunctors.dir/testBasicBoolFunctors.cpp.o.d"
+  "testBasicBoolFunctors"
+  "testBasicBoolFunctors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBasicBoolFunctors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testBits.dir/testBits.cpp.o"
+  "CMakeFiles/testBits.dir/testBits.cpp.o.d"
+  "testBits"
+  "testBits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testBits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCirculator.dir/testCirculator.cpp.o"
+  "CMakeFiles/testCirculator.dir/testCirculator.cpp.o.d"
+  "testCirculator"
+  "testCirculator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCirculator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
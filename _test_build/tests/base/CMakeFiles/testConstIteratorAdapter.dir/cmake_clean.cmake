@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testConstIteratorAdapter.dir/testConstIteratorAdapter.cpp.o"
+  "CMakeFiles/testConstIteratorAdapter.dir/testConstIteratorAdapter.cpp.o.d"
+  "testConstIteratorAdapter"
+  "testConstIteratorAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testConstIteratorAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testConstRangeAdapter.dir/testConstRangeAdapter.cpp.o"
+  "CMakeFiles/testConstRangeAdapter.dir/testConstRangeAdapter.cpp.o.d"
+  "testConstRangeAdapter"
+  "testConstRangeAdapter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testConstRangeAdapter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
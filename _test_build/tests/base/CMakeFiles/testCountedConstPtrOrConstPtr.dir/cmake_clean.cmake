@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCountedConstPtrOrConstPtr.dir/testCountedConstPtrOrConstPtr.cpp.o"
+  "CMakeFiles/testCountedConstPtrOrConstPtr.dir/testCountedConstPtrOrConstPtr.cpp.o.d"
+  "testCountedConstPtrOrConstPtr"
+  "testCountedConstPtrOrConstPtr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCountedConstPtrOrConstPtr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testCountedPtrOrPtr.dir/testCountedPtrOrPtr.cpp.o"
+  "CMakeFiles/testCountedPtrOrPtr.dir/testCountedPtrOrPtr.cpp.o.d"
+  "testCountedPtrOrPtr"
+  "testCountedPtrOrPtr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testCountedPtrOrPtr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testFlatHashMap.dir/testFlatHashMap.cpp.o"
+  "CMakeFiles/testFlatHashMap.dir/testFlatHashMap.cpp.o.d"
+  "testFlatHashMap"
+  "testFlatHashMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testFlatHashMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testFunctorHolder.dir/testFunctorHolder.cpp.o"
+  "CMakeFiles/testFunctorHolder.dir/testFunctorHolder.cpp.o.d"
+  "testFunctorHolder"
+  "testFunctorHolder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testFunctorHolder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testIndexedListWithBlocks.dir/testIndexedListWithBlocks.cpp.o"
+  "CMakeFiles/testIndexedListWithBlocks.dir/testIndexedListWithBlocks.cpp.o.d"
+  "testIndexedListWithBlocks"
+  "testIndexedListWithBlocks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testIndexedListWithBlocks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testIteratorCirculatorTraits.dir/testIteratorCirculatorTraits.cpp.o"
+  "CMakeFiles/testIteratorCirculatorTraits.dir/testIteratorCirculatorTraits.cpp.o.d"
+  "testIteratorCirculatorTraits"
+  "testIteratorCirculatorTraits.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testIteratorCirculatorTraits.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testIteratorFunctions.dir/testIteratorFunctions.cpp.o"
+  "CMakeFiles/testIteratorFunctions.dir/testIteratorFunctions.cpp.o.d"
+  "testIteratorFunctions"
+  "testIteratorFunctions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testIteratorFunctions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
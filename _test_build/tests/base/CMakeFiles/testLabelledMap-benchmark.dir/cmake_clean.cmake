@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLabelledMap-benchmark.dir/testLabelledMap-benchmark.cpp.o"
+  "CMakeFiles/testLabelledMap-benchmark.dir/testLabelledMap-benchmark.cpp.o.d"
+  "testLabelledMap-benchmark"
+  "testLabelledMap-benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLabelledMap-benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
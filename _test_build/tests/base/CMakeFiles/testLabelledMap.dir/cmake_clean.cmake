@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLabelledMap.dir/testLabelledMap.cpp.o"
+  "CMakeFiles/testLabelledMap.dir/testLabelledMap.cpp.o.d"
+  "testLabelledMap"
+  "testLabelledMap.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLabelledMap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
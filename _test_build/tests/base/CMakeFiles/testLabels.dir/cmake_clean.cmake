@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testLabels.dir/testLabels.cpp.o"
+  "CMakeFiles/testLabels.dir/testLabels.cpp.o.d"
+  "testLabels"
+  "testLabels.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testLabels.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
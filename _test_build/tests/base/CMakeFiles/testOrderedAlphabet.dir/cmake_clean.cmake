@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testOrderedAlphabet.dir/testOrderedAlphabet.cpp.o"
+  "CMakeFiles/testOrderedAlphabet.dir/testOrderedAlphabet.cpp.o.d"
+  "testOrderedAlphabet"
+  "testOrderedAlphabet.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testOrderedAlphabet.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testParallelExecutor.dir/testParallelExecutor.cpp.o"
+  "CMakeFiles/testParallelExecutor.dir/testParallelExecutor.cpp.o.d"
+  "testParallelExecutor"
+  "testParallelExecutor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testParallelExecutor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testPartialTemplateSpecialization.dir/testPartialTemplateSpecialization.cpp.o"
+  "CMakeFiles/testPartialTemplateSpecialization.dir/testPartialTemplateSpecialization.cpp.o.d"
+  "testPartialTemplateSpecialization"
+  "testPartialTemplateSpecialization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testPartialTemplateSpecialization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSimpleRandomAccessRangeFromPoint.dir/testSimpleRandomAccessRangeFromPoint.cpp.o"
+  "CMakeFiles/testSimpleRandomAccessRangeFromPoint.dir/testSimpleRandomAccessRangeFromPoint.cpp.o.d"
+  "testSimpleRandomAccessRangeFromPoint"
+  "testSimpleRandomAccessRangeFromPoint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSimpleRandomAccessRangeFromPoint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
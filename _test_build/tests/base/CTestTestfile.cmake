@@ -0,0 +1,70 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/base
+# Build directory: /root/repo/_test_build/tests/base
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testBasicBoolFunctors "testBasicBoolFunctors")
+set_tests_properties(testBasicBoolFunctors PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testOrderedAlphabet "testOrderedAlphabet")
+set_tests_properties(testOrderedAlphabet PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testCirculator "testCirculator")
+set_tests_properties(testCirculator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testConstIteratorAdapter "testConstIteratorAdapter")
+set_tests_properties(testConstIteratorAdapter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testProgressBar "testProgressBar")
+set_tests_properties(testProgressBar PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testBasicFunctors "testBasicFunctors")
+set_tests_properties(testBasicFunctors PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testConstRangeAdapter "testConstRangeAdapter")
+set_tests_properties(testConstRangeAdapter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testOutputIteratorAdapter "testOutputIteratorAdapter")
+set_tests_properties(testOutputIteratorAdapter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testClock "testClock")
+set_tests_properties(testClock PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testTrace "testTrace")
+set_tests_properties(testTrace PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testCountedPtr "testCountedPtr")
+set_tests_properties(testCountedPtr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testCountedPtrOrPtr "testCountedPtrOrPtr")
+set_tests_properties(testCountedPtrOrPtr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testCountedConstPtrOrConstPtr "testCountedConstPtrOrConstPtr")
+set_tests_properties(testCountedConstPtrOrConstPtr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testBits "testBits")
+set_tests_properties(testBits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testIndexedListWithBlocks "testIndexedListWithBlocks")
+set_tests_properties(testIndexedListWithBlocks PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testLabels "testLabels")
+set_tests_properties(testLabels PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testLabelledMap "testLabelledMap")
+set_tests_properties(testLabelledMap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testFlatHashMap "testFlatHashMap")
+set_tests_properties(testFlatHashMap PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testLabelledMap-benchmark "testLabelledMap-benchmark")
+set_tests_properties(testLabelledMap-benchmark PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testMultiMap-benchmark "testMultiMap-benchmark")
+set_tests_properties(testMultiMap-benchmark PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testOpenMP "testOpenMP")
+set_tests_properties(testOpenMP PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testParallelExecutor "testParallelExecutor")
+set_tests_properties(testParallelExecutor PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testIteratorFunctions "testIteratorFunctions")
+set_tests_properties(testIteratorFunctions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testIteratorCirculatorTraits "testIteratorCirculatorTraits")
+set_tests_properties(testIteratorCirculatorTraits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testCloneAndAliases "testCloneAndAliases")
+set_tests_properties(testCloneAndAliases PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testClone2 "testClone2")
+set_tests_properties(testClone2 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testOwningOrAliasingPtr "testOwningOrAliasingPtr")
+set_tests_properties(testOwningOrAliasingPtr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testPartialTemplateSpecialization "testPartialTemplateSpecialization")
+set_tests_properties(testPartialTemplateSpecialization PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testContainerTraits "testContainerTraits")
+set_tests_properties(testContainerTraits PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testSetFunctions "testSetFunctions")
+set_tests_properties(testSetFunctions PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testSimpleRandomAccessRangeFromPoint "testSimpleRandomAccessRangeFromPoint")
+set_tests_properties(testSimpleRandomAccessRangeFromPoint PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
+add_test(testFunctorHolder "testFunctorHolder")
+set_tests_properties(testFunctorHolder PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/base/CMakeLists.txt;36;DGtal_add_test;/root/repo/tests/base/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testAlphaThickSegmentComputer.dir/testAlphaThickSegmentComputer.cpp.o"
+  "CMakeFiles/testAlphaThickSegmentComputer.dir/testAlphaThickSegmentComputer.cpp.o.d"
+  "testAlphaThickSegmentComputer"
+  "testAlphaThickSegmentComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testAlphaThickSegmentComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
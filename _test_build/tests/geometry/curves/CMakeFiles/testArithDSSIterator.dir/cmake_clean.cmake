@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArithDSSIterator.dir/testArithDSSIterator.cpp.o"
+  "CMakeFiles/testArithDSSIterator.dir/testArithDSSIterator.cpp.o.d"
+  "testArithDSSIterator"
+  "testArithDSSIterator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArithDSSIterator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArithmeticalDSL.dir/testArithmeticalDSL.cpp.o"
+  "CMakeFiles/testArithmeticalDSL.dir/testArithmeticalDSL.cpp.o.d"
+  "testArithmeticalDSL"
+  "testArithmeticalDSL.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArithmeticalDSL.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArithmeticalDSSComputer.dir/testArithmeticalDSSComputer.cpp.o"
+  "CMakeFiles/testArithmeticalDSSComputer.dir/testArithmeticalDSSComputer.cpp.o.d"
+  "testArithmeticalDSSComputer"
+  "testArithmeticalDSSComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArithmeticalDSSComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
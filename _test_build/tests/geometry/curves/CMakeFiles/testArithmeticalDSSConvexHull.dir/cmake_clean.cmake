@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testArithmeticalDSSConvexHull.dir/testArithmeticalDSSConvexHull.cpp.o"
+  "CMakeFiles/testArithmeticalDSSConvexHull.dir/testArithmeticalDSSConvexHull.cpp.o.d"
+  "testArithmeticalDSSConvexHull"
+  "testArithmeticalDSSConvexHull.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testArithmeticalDSSConvexHull.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
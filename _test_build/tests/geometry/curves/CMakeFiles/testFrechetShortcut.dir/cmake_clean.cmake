@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testFrechetShortcut.dir/testFrechetShortcut.cpp.o"
+  "CMakeFiles/testFrechetShortcut.dir/testFrechetShortcut.cpp.o.d"
+  "testFrechetShortcut"
+  "testFrechetShortcut.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testFrechetShortcut.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testFreemanChain.dir/testFreemanChain.cpp.o"
+  "CMakeFiles/testFreemanChain.dir/testFreemanChain.cpp.o.d"
+  "testFreemanChain"
+  "testFreemanChain.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testFreemanChain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
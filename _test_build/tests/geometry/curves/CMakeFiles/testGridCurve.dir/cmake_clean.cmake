@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testGridCurve.dir/testGridCurve.cpp.o"
+  "CMakeFiles/testGridCurve.dir/testGridCurve.cpp.o.d"
+  "testGridCurve"
+  "testGridCurve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testGridCurve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testParametricCurveDigitization.dir/testParametricCurveDigitization.cpp.o"
+  "CMakeFiles/testParametricCurveDigitization.dir/testParametricCurveDigitization.cpp.o.d"
+  "testParametricCurveDigitization"
+  "testParametricCurveDigitization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testParametricCurveDigitization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
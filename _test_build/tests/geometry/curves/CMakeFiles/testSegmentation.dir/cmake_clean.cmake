@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testSegmentation.dir/testSegmentation.cpp.o"
+  "CMakeFiles/testSegmentation.dir/testSegmentation.cpp.o.d"
+  "testSegmentation"
+  "testSegmentation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testSegmentation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testStabbingCircleComputer.dir/testStabbingCircleComputer.cpp.o"
+  "CMakeFiles/testStabbingCircleComputer.dir/testStabbingCircleComputer.cpp.o.d"
+  "testStabbingCircleComputer"
+  "testStabbingCircleComputer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testStabbingCircleComputer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,45 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/geometry/curves
+# Build directory: /root/repo/_test_build/tests/geometry/curves
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(testArithDSS3d "testArithDSS3d")
+set_tests_properties(testArithDSS3d PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testFreemanChain "testFreemanChain")
+set_tests_properties(testFreemanChain PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testSegmentation "testSegmentation")
+set_tests_properties(testSegmentation PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testFP "testFP")
+set_tests_properties(testFP PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testGridCurve "testGridCurve")
+set_tests_properties(testGridCurve PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testCombinDSS "testCombinDSS")
+set_tests_properties(testCombinDSS PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testStabbingLineComputer "testStabbingLineComputer")
+set_tests_properties(testStabbingLineComputer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testStabbingCircleComputer "testStabbingCircleComputer")
+set_tests_properties(testStabbingCircleComputer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testBinomialConvolver "testBinomialConvolver")
+set_tests_properties(testBinomialConvolver PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testFrechetShortcut "testFrechetShortcut")
+set_tests_properties(testFrechetShortcut PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testArithmeticalDSS "testArithmeticalDSS")
+set_tests_properties(testArithmeticalDSS PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testArithmeticalDSLKernel "testArithmeticalDSLKernel")
+set_tests_properties(testArithmeticalDSLKernel PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testArithmeticalDSSComputer "testArithmeticalDSSComputer")
+set_tests_properties(testArithmeticalDSSComputer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testArithmeticalDSL "testArithmeticalDSL")
+set_tests_properties(testArithmeticalDSL PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testDSLSubsegment "testDSLSubsegment")
+set_tests_properties(testDSLSubsegment PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testArithDSSIterator "testArithDSSIterator")
+set_tests_properties(testArithDSSIterator PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testArithmeticalDSSConvexHull "testArithmeticalDSSConvexHull")
+set_tests_properties(testArithmeticalDSSConvexHull PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testAlphaThickSegmentComputer "testAlphaThickSegmentComputer")
+set_tests_properties(testAlphaThickSegmentComputer PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+add_test(testParametricCurveDigitization "testParametricCurveDigitization")
+set_tests_properties(testParametricCurveDigitization PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/tests/TestFunctions.cmake;7;add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;27;DGtal_add_test;/root/repo/tests/geometry/curves/CMakeLists.txt;0;")
+subdirs("estimation")